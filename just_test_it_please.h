@@ -34,12 +34,19 @@
 //               JT_THEN( "the result is true" ); 
 //               JT_CHECK(11 == 11);
 //           }
+//
+//           JT_TEST_ENTRY("a property-based test") {
+//               JT_FORALL(Jt::forall(Jt::gen::ints(-1000, 1000), Jt::gen::strings(Jt::gen::chars(), 0, 8)),
+//                   [](int n, const std::string& s) { return s.size() <= 8 && n * n >= 0; });
+//           }
 //               
 //      - see just_test_it_please.cpp for examples.
 //
 // History:
 // - Version 0.1: 9/25/2024
 //    - initial release
+// - Version 0.2: 10/18/2026
+//    - Jt::forall / JT_FORALL property-based testing with shrinking
 //======================================================================================
 #pragma once
 
@@ -53,6 +60,15 @@
 #include <cassert>
 #include <sstream>
 #include <iterator>
+#include <tuple>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
 
 
 struct JtScope {
@@ -395,6 +411,463 @@ namespace Jt {
     }
 }
 
+// Small, fast, seedable PRNG (SplitMix64) used to drive Jt::forall.
+struct JtRng {
+    inline explicit JtRng(uint64_t seed = 0) : State(seed) {}
+
+    inline uint64_t Next() {
+        uint64_t z = (State += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [0, n); n == 0 means the full 64-bit range.
+    inline uint64_t Below(uint64_t n) {
+        uint64_t x = Next();
+        if (n == 0) {
+            return x;
+        }
+        // High 64 bits of x * n (multiply-shift, no division)
+        uint64_t xl = x & 0xffffffff, xh = x >> 32;
+        uint64_t nl = n & 0xffffffff, nh = n >> 32;
+        uint64_t lh = xl * nh, hl = xh * nl;
+        uint64_t mid = ((xl * nl) >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+        return xh * nh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    }
+
+    // Uniform in [0, 1)
+    inline double Unit() {
+        return double(Next() >> 11) * 0x1.0p-53;
+    }
+
+    uint64_t State;
+};
+
+// Generators for Jt::forall.  A generator has a value_type and two members:
+//      void Generate(JtRng& rng, value_type& out) const;
+//          - fills 'out' in place, so containers reuse their capacity between cases
+//      bool Shrink(const value_type& v, F&& accept) const;
+//          - offers simpler candidates to accept(candidate), stopping at the
+//            first one it takes (returns true), or false when there are none left
+namespace Jt::gen {
+    template <typename T>
+    struct Ints {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+        using value_type = T;
+        using U = std::make_unsigned_t<T>;
+
+        T Lo;
+        T Hi;
+
+        // The value shrinking heads for: zero, or the bound nearest to it
+        inline T Target() const {
+            return Lo > 0 ? Lo : Hi < 0 ? Hi : T(0);
+        }
+
+        inline void Generate(JtRng& rng, T& out) const {
+            uint64_t r = rng.Next();
+            if ((r & 15) == 0) {
+                // Bounds and zero are where the bugs live; hit them often
+                const T edges[] = { Lo, Hi, Target() };
+                out = edges[(r >> 4) % 3];
+                return;
+            }
+            uint64_t span = uint64_t(U(U(Hi) - U(Lo))) + 1;  // 0 for the full 64-bit range
+            if ((span == 0 || span > (1 << 16)) && ((r >> 8) & 3) == 0) {
+                // Large span: uniform draws are almost never small, so a quarter
+                // of the time take a log-uniform distance from the target instead
+                T t = Target();
+                uint64_t dist = rng.Next() >> (63 - rng.Below(sizeof(T) * 8));
+                uint64_t up = uint64_t(U(U(Hi) - U(t)));
+                uint64_t down = uint64_t(U(U(t) - U(Lo)));
+                bool goUp = down == 0 || (up != 0 && ((r >> 10) & 1));
+                if (dist <= (goUp ? up : down)) {
+                    out = goUp ? T(U(U(t) + U(dist))) : T(U(U(t) - U(dist)));
+                    return;
+                }
+            }
+            out = T(U(U(Lo) + U(rng.Below(span))));
+        }
+
+        template <typename F>
+        bool Shrink(const T& v, F&& accept) const {
+            // Jump straight to the target, then try ever smaller steps towards it
+            T t = Target();
+            U dist = v < t ? U(U(t) - U(v)) : U(U(v) - U(t));
+            for (U step = dist; step != 0; step >>= 1) {
+                if (accept(v < t ? T(U(U(v) + step)) : T(U(U(v) - step)))) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    template <typename T>
+    struct Floats {
+        static_assert(std::is_floating_point_v<T>);
+        using value_type = T;
+
+        T Lo;
+        T Hi;
+
+        inline T Target() const {
+            return Lo > 0 ? Lo : Hi < 0 ? Hi : T(0);
+        }
+
+        inline void Generate(JtRng& rng, T& out) const {
+            uint64_t r = rng.Next();
+            if ((r & 15) == 0) {
+                const T edges[] = { Lo, Hi, Target() };
+                out = edges[(r >> 4) % 3];
+                return;
+            }
+            if (!(Hi - Lo <= T(1 << 20)) && ((r >> 8) & 1) == 0) {
+                // Wide range: uniform draws would all be huge, so half the time
+                // pick a log-uniform magnitude off the target instead
+                T t = Target();
+                int maxExp = std::ilogb(std::max(std::abs(Lo), std::abs(Hi)));
+                int exp = int(rng.Below(uint64_t(2 * maxExp + 1))) - maxExp;
+                T magnitude = std::ldexp(T(1 + rng.Unit()), exp);
+                bool up = t == Lo || (t != Hi && ((r >> 9) & 1));
+                T v = up ? t + magnitude : t - magnitude;
+                if (v >= Lo && v <= Hi) {
+                    out = v;
+                    return;
+                }
+            }
+            T u = T(rng.Unit());
+            out = std::clamp(Lo * (1 - u) + Hi * u, Lo, Hi);  // no overflow for huge ranges
+        }
+
+        template <typename F>
+        bool Shrink(const T& v, F&& accept) const {
+            T t = Target();
+            if (v == t) {
+                return false;
+            }
+            if (accept(t)) {
+                return true;
+            }
+            T whole = std::trunc(v);
+            if (whole != v && whole >= Lo && whole <= Hi && accept(whole)) {
+                return true;
+            }
+            T step = (v - t) / 2;
+            for (int j = 0; j < 64 && v - step != v; ++j, step /= 2) {
+                if (accept(v - step)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    // Any resizable sequence (std::string, std::vector, ...) of generated elements
+    template <typename TSeq, typename TElemGen>
+    struct Sequence {
+        using value_type = TSeq;
+        using TElem = typename TSeq::value_type;
+
+        TElemGen    Elem;
+        size_t      MinLen;
+        size_t      MaxLen;
+
+        // Elements trimmed off a shorter case, kept (with their capacity) for
+        // the next longer one, so nested containers stop allocating once warm.
+        mutable std::vector<TElem>  Spare = {};
+
+        inline void Generate(JtRng& rng, TSeq& out) const {
+            size_t len = MinLen + size_t(rng.Below(uint64_t(MaxLen - MinLen) + 1));
+            if constexpr (std::is_trivially_destructible_v<TElem>) {
+                out.resize(len);
+            }
+            else {
+                for (; out.size() > len; out.pop_back()) {
+                    Spare.push_back(std::move(out.back()));
+                }
+                for (; out.size() < len; Spare.pop_back()) {
+                    if (Spare.empty()) {
+                        out.resize(len);
+                        break;
+                    }
+                    out.push_back(std::move(Spare.back()));
+                }
+            }
+            for (auto& e : out) {
+                Elem.Generate(rng, e);
+            }
+        }
+
+        template <typename F>
+        bool Shrink(const TSeq& v, F&& accept) const {
+            // First drop chunks, largest first, down to single elements...
+            TSeq candidate;
+            for (size_t chunk = v.size() - std::min(MinLen, v.size()); chunk > 0; chunk /= 2) {
+                for (size_t at = 0; at + chunk <= v.size(); at += chunk) {
+                    candidate.assign(v.begin(), v.begin() + at);
+                    candidate.insert(candidate.end(), v.begin() + at + chunk, v.end());
+                    if (accept(candidate)) {
+                        return true;
+                    }
+                }
+            }
+            // ...then simplify the remaining elements one at a time
+            candidate = v;
+            for (size_t i = 0; i < v.size(); ++i) {
+                bool taken = Elem.Shrink(v[i], [&](const auto& e) {
+                    candidate[i] = e;
+                    return accept(candidate);
+                });
+                if (taken) {
+                    return true;
+                }
+                candidate[i] = v[i];
+            }
+            return false;
+        }
+    };
+
+    template <typename T = int>
+    Ints<T> ints(T lo = std::numeric_limits<T>::lowest(), T hi = std::numeric_limits<T>::max()) {
+        assert(lo <= hi);
+        return { lo, hi };
+    }
+
+    template <typename T = double>
+    Floats<T> floats(T lo = std::numeric_limits<T>::lowest(), T hi = std::numeric_limits<T>::max()) {
+        assert(lo <= hi);
+        return { lo, hi };
+    }
+
+    inline Ints<char> chars(char lo = ' ', char hi = '~') {
+        return ints<char>(lo, hi);
+    }
+
+    inline Sequence<std::string, Ints<char>> strings(Ints<char> elem = chars(), size_t minLen = 0, size_t maxLen = 16) {
+        assert(minLen <= maxLen);
+        return { elem, minLen, maxLen };
+    }
+
+    template <typename TElemGen>
+    Sequence<std::vector<typename TElemGen::value_type>, TElemGen> vectors(TElemGen elem, size_t minLen = 0, size_t maxLen = 16) {
+        assert(minLen <= maxLen);
+        return { elem, minLen, maxLen };
+    }
+}
+
+namespace Jt {
+    // Quotes the text, escaping anything that would not print as itself
+    inline std::string quoted(std::string_view text, char quote) {
+        std::string result(1, quote);
+        for (char c : text) {
+            switch (c) {
+            case '\n': result.append("\\n"); break;
+            case '\r': result.append("\\r"); break;
+            case '\t': result.append("\\t"); break;
+            case '\\': result.append("\\\\"); break;
+            default:
+                if (c == quote) {
+                    result.append({ '\\', c });
+                }
+                else if (c < ' ' || c > '~') {
+                    result.append(std::format("\\x{:02x}", (unsigned char)c));
+                }
+                else {
+                    result.push_back(c);
+                }
+            }
+        }
+        result.push_back(quote);
+        return result;
+    }
+
+    template <typename T>
+    std::string formatValue(const T& value) {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            return quoted(std::string_view(value), '"');
+        }
+        else if constexpr (std::is_same_v<T, char>) {
+            return quoted(std::string_view(&value, 1), '\'');
+        }
+        else if constexpr (std::ranges::range<T>) {
+            std::string result = "[";
+            auto sep = "";
+            for (const auto& v : value) {
+                result.append(sep);
+                result.append(formatValue(v));
+                sep = ", ";
+            }
+            return result + "]";
+        }
+        else {
+            return std::format("{}", value);
+        }
+    }
+}
+
+// Runs a predicate over generated inputs; see Jt::forall and JT_FORALL.
+//
+// Cases are generated a batch at a time into buffers that are reused for the
+// whole run, and are evaluated without opening a scope each.  The first failing
+// case is shrunk towards a minimal counterexample, which is then reported
+// (with the seed needed to reproduce it) through a single "FORALL:" scope.
+//
+// The predicate takes one argument per generator and either returns bool,
+// or returns void and uses JT_CHECK (slower: each check opens a scope).
+template <typename... TGens>
+class JtForall {
+public:
+    using Values = std::tuple<typename TGens::value_type...>;
+
+    JtForall(TGens... gens)
+        : m_gens(gens...), m_seed(RandomSeed()), m_cases(100000), m_maxShrinks(10000), m_batchSize(256) {
+    }
+
+    JtForall& Seed(uint64_t seed) { m_seed = seed; return *this; }
+    JtForall& Cases(size_t cases) { m_cases = cases; return *this; }
+    JtForall& MaxShrinks(size_t maxShrinks) { m_maxShrinks = maxShrinks; return *this; }
+    JtForall& BatchSize(size_t batchSize) { m_batchSize = std::max(size_t(1), batchSize); return *this; }
+
+    uint64_t Seed() const { return m_seed; }
+
+    // The shrunk counterexample from the last Check(), if it failed
+    const std::optional<Values>& Counterexample() const { return m_counterexample; }
+
+    template <typename TPred>
+    bool Check(TPred pred) {
+        return Check("", 0, "", pred);
+    }
+
+    template <typename TPred>
+    bool Check(const std::string& file, int line, const std::string& text, TPred pred) {
+        JtScope scope({ file, line, std::string("FORALL: ") + text });
+        m_counterexample.reset();
+        size_t failedCase = 0;
+        size_t shrinkSteps = 0;
+        {
+            // Checks made by the predicate must not leak out while we search
+            JtScope isolation({}, true);
+            auto& fails = isolation.Event["fail"];
+            auto isFailure = [&](const Values& values) {
+                size_t failsBefore = fails.Count;
+                return !Invoke(pred, values) || fails.Count != failsBefore;
+            };
+
+            JtRng rng(m_seed);
+            std::vector<Values> batch(std::min(m_batchSize, m_cases));
+            for (size_t done = 0; done < m_cases && !m_counterexample; done += batch.size()) {
+                size_t n = std::min(batch.size(), m_cases - done);
+                for (size_t j = 0; j < n; ++j) {
+                    Generate(rng, batch[j], std::index_sequence_for<TGens...>{});
+                }
+                for (size_t j = 0; j < n; ++j) {
+                    if (isFailure(batch[j])) {
+                        m_counterexample = batch[j];
+                        failedCase = done + j;
+                        break;
+                    }
+                }
+            }
+            if (!m_counterexample) {
+                scope.Text.append(std::format("\ncases: {}, seed: {:#x}", m_cases, m_seed));
+                isolation.Close();
+                scope.FireEvent("pass");
+                return true;
+            }
+            shrinkSteps = Shrink(*m_counterexample, isFailure);
+        }
+
+        std::string values = "";
+        auto sep = "";
+        std::apply([&](const auto&... v) {
+            ((values.append(sep), values.append(Jt::formatValue(v)), sep = ", "), ...);
+        }, *m_counterexample);
+        scope.Text.append(std::format("\ncounterexample: ({})\nfailed case {} of {}, shrunk in {} steps"
+            "\nseed: {:#x}, reproduce with .Seed({:#x})",
+            values, failedCase + 1, m_cases, shrinkSteps, m_seed, m_seed));
+
+        // Run the counterexample once more in the open, so any JT_CHECKs in
+        // the predicate report their own detail beneath this scope.
+        // If it only returned false (or a stateful predicate passes this time),
+        // the failure is reported against this scope.
+        Invoke(pred, *m_counterexample);
+        if (scope.FailCount() == 0) {
+            scope.FireEvent("fail");
+        }
+        return false;
+    }
+
+private:
+    static uint64_t RandomSeed() {
+        std::random_device rd;
+        return (uint64_t(rd()) << 32) ^ rd();
+    }
+
+    template <typename TPred>
+    static bool Invoke(TPred& pred, const Values& values) {
+        if constexpr (std::is_void_v<std::invoke_result_t<TPred&, const typename TGens::value_type&...>>) {
+            std::apply(pred, values);
+            return true;
+        }
+        else {
+            return bool(std::apply(pred, values));
+        }
+    }
+
+    template <size_t... Is>
+    void Generate(JtRng& rng, Values& values, std::index_sequence<Is...>) const {
+        (std::get<Is>(m_gens).Generate(rng, std::get<Is>(values)), ...);
+    }
+
+    // Greedily accept any simpler candidate that still fails, until none do
+    // or the evaluation budget runs out.  Returns the number of steps taken.
+    template <typename TIsFailure>
+    size_t Shrink(Values& best, TIsFailure& isFailure) const {
+        size_t steps = 0;
+        size_t evaluations = 0;
+        Values candidate = best;
+        auto shrinkOne = [&]<size_t I>(std::integral_constant<size_t, I>) {
+            bool taken = std::get<I>(m_gens).Shrink(std::get<I>(best), [&](const auto& c) {
+                if (evaluations >= m_maxShrinks) {
+                    return false;
+                }
+                ++evaluations;
+                std::get<I>(candidate) = c;
+                return isFailure(candidate);
+            });
+            if (taken) {
+                std::get<I>(best) = std::get<I>(candidate);
+            }
+            else {
+                std::get<I>(candidate) = std::get<I>(best);
+            }
+            return taken;
+        };
+        while (evaluations < m_maxShrinks && [&]<size_t... Is>(std::index_sequence<Is...>) {
+            return (shrinkOne(std::integral_constant<size_t, Is>{}) || ...);
+        }(std::index_sequence_for<TGens...>{})) {
+            ++steps;
+        }
+        return steps;
+    }
+
+    std::tuple<TGens...>    m_gens;
+    uint64_t                m_seed;
+    size_t                  m_cases;
+    size_t                  m_maxShrinks;
+    size_t                  m_batchSize;
+    std::optional<Values>   m_counterexample;
+};
+
+namespace Jt {
+    template <typename... TGens>
+    JtForall<TGens...> forall(TGens... gens) {
+        return JtForall<TGens...>(gens...);
+    }
+}
+
 struct JtTestEntry {
     JtTestEntry(std::string file, int line, std::function<void()> entry, std::initializer_list<std::string_view> names) :
         File(file), Line(line), Func(entry), Names{ names } {
@@ -530,6 +1003,10 @@ struct JtTestRunner : JtScope {
 #define JT_CHECK_EQ(LHS, RHS) JT_CHECK_BINOP(==, LHS, RHS)
 #define JT_CHECK_NEQ(LHS, RHS) JT_CHECK_BINOP(!=, LHS, RHS)
 
+// JT_FORALL(Jt::forall(generators...), predicate) - property check with file/line
+#define JT_FORALL(FORALL, ...) \
+    (FORALL).Check(__FILE__, __LINE__, #FORALL, __VA_ARGS__)
+
 #define JT_DEFINE_ENUM(T_TYPE,...) \
     template <> \
     struct std::formatter<T_TYPE> : std::formatter<std::string> { \
@@ -60,6 +60,217 @@ JT_TEST_ENTRY("jt-test", "Jt::iterate stops iterating after specified failure co
 }
 
 
+//------ forall tests ----------------------------------------
+JT_TEST_ENTRY("jt-test", "Jt::forall passes a true property without reporting each case") {
+    JT_GIVEN("a million generated (int, double, string) cases");
+    JT_THEN("a property that holds for all of them passes with a single scope");
+
+    JtTestRunner tr;
+    size_t passesBefore = tr.Event["pass"].Count;
+    bool ok = Jt::forall(Jt::gen::ints(-100, 100), Jt::gen::floats(-1.0, 1.0), Jt::gen::strings(Jt::gen::chars(), 2, 5))
+        .Cases(1000000)
+        .Check([](int n, double d, const std::string& s) {
+            return n >= -100 && n <= 100 && d >= -1.0 && d <= 1.0 && s.size() >= 2 && s.size() <= 5;
+        });
+    size_t passes = tr.Event["pass"].Count - passesBefore;
+    tr.Close();
+
+    JT_CHECK(ok);
+    JT_CHECK_EQ(tr.FailCount(), 0);
+    JT_CHECK_EQ(passes, 1);
+}
+
+JT_TEST_ENTRY("jt-test", "Jt::forall opens no scope per case") {
+    JT_GIVEN("a true property run for 10 and for 100000 cases");
+    JT_THEN("both runs open the same number of scopes, "
+        "and every case runs under the same enclosing scope");
+
+    JtTestRunner tr;
+    auto run = [&](size_t cases, size_t& scopeChanges) {
+        size_t opens = 0;
+        JtScopePtr caseScope;
+        Jt::forall(Jt::gen::ints()).Cases(cases).Check([&](int) {
+            auto top = JtScope::GetStack().top();
+            if (caseScope == nullptr) {
+                // Cases run under a root scope of their own, so listen at the
+                // outermost scope the predicate sees to count what opens there
+                auto outermost = top;
+                while (outermost->Parent != nullptr) {
+                    outermost = outermost->Parent;
+                }
+                outermost->Listeners.push_back([&](const JtScope::EventArgs& e) {
+                    opens += e.Name == "open";
+                });
+            }
+            scopeChanges += caseScope != nullptr && top != caseScope;
+            caseScope = top;
+            return true;
+        });
+        return opens;
+    };
+    size_t fewChanges = 0, manyChanges = 0;
+    size_t fewOpens = run(10, fewChanges);
+    size_t manyOpens = run(100000, manyChanges);
+    tr.Close();
+
+    JT_CHECK_EQ(fewOpens, manyOpens);
+    JT_CHECK_EQ(fewChanges, 0);
+    JT_CHECK_EQ(manyChanges, 0);
+}
+
+namespace {
+    size_t g_countedAllocations = 0;
+
+    template <typename T>
+    struct CountingAllocator {
+        using value_type = T;
+        CountingAllocator() = default;
+        template <typename U> CountingAllocator(const CountingAllocator<U>&) {}
+        T* allocate(size_t n) { ++g_countedAllocations; return std::allocator<T>().allocate(n); }
+        void deallocate(T* p, size_t n) { std::allocator<T>().deallocate(p, n); }
+        template <typename U> bool operator==(const CountingAllocator<U>&) const { return true; }
+    };
+
+    using CountedString = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+}
+
+JT_TEST_ENTRY("jt-test", "Jt::forall does not allocate per case for nested containers") {
+    JT_GIVEN("a vector-of-strings generator that counts its allocations");
+    JT_WHEN("a true property is run for 20000 and for 200000 cases with the same seed");
+    JT_THEN("the extra cases add (next to) no allocations");
+
+    using Strings = Jt::gen::Sequence<CountedString, Jt::gen::Ints<char>>;
+    using Vectors = Jt::gen::Sequence<std::vector<CountedString, CountingAllocator<CountedString>>, Strings>;
+    auto allocations = [](size_t cases) {
+        JtTestRunner tr;
+        size_t before = g_countedAllocations;
+        Jt::forall(Vectors{ Strings{ Jt::gen::chars(), 16, 40 }, 0, 8 })
+            .Seed(1).Cases(cases).Check([](const auto& v) { return v.size() <= 8; });
+        return g_countedAllocations - before;
+    };
+    size_t fewer = allocations(20000);
+    size_t more = allocations(200000);
+
+    // Pooled strings may still grow to their largest size now and then,
+    // but nowhere near once per case.
+    JT_CHECK(more - fewer < 1000, "fewer: {}, more: {}", fewer, more);
+}
+
+JT_TEST_ENTRY("jt-test", "Jt::forall shrinks failures to a minimal counterexample") {
+    JT_GIVEN("properties that fail for some generated inputs");
+    JT_THEN("each reports one failure with the smallest failing input");
+
+    JtTestRunner tr;
+    auto ints = Jt::forall(Jt::gen::ints(0, 1000000));
+    bool intsOk = ints.Check([](int n) { return n < 500; });
+
+    auto strings = Jt::forall(Jt::gen::strings(Jt::gen::chars('a', 'z'), 0, 20));
+    bool stringsOk = strings.Check([](const std::string& s) { return s.find('q') == std::string::npos; });
+
+    auto vectors = Jt::forall(Jt::gen::vectors(Jt::gen::ints(0, 100), 0, 10));
+    bool vectorsOk = vectors.Check([](const std::vector<int>& v) {
+        for (auto n : v) {
+            if (n >= 10) return false;
+        }
+        return true;
+    });
+
+    auto floats = Jt::forall(Jt::gen::floats(-1000.0, 1000.0));
+    bool floatsOk = floats.Check([](double d) { return d < 3.0; });
+    tr.Close();
+
+    JT_CHECK(!intsOk && !stringsOk && !vectorsOk && !floatsOk);
+    JT_CHECK_EQ(tr.FailCount(), 4);
+    JT_CHECK_EQ(std::get<0>(*ints.Counterexample()), 500);
+    JT_CHECK_EQ(std::get<0>(*strings.Counterexample()), "q");
+    JT_CHECK(std::get<0>(*vectors.Counterexample()) == std::vector<int>{ 10 });
+    JT_CHECK_EQ(std::get<0>(*floats.Counterexample()), 3.0);
+}
+
+JT_TEST_ENTRY("jt-test", "Jt::forall default generators reach ordinary magnitudes") {
+    JT_GIVEN("properties that fail only inside a moderate band of values");
+    JT_THEN("the full-range default generators still find a counterexample in the band");
+
+    JtTestRunner tr;
+    auto floats = Jt::forall(Jt::gen::floats()).Seed(5);
+    bool floatsOk = floats.Check([](double d) { return !(d > 1 && d < 1e6); });
+    auto ints = Jt::forall(Jt::gen::ints()).Seed(5);
+    bool intsOk = ints.Check([](int n) { return !(n >= 1 && n <= 100); });
+    tr.Close();
+
+    JT_CHECK(!floatsOk);
+    if (floats.Counterexample()) {
+        double d = std::get<0>(*floats.Counterexample());
+        JT_CHECK(d > 1 && d < 1e6, "d = {}", d);
+    }
+    JT_CHECK(!intsOk);
+    if (ints.Counterexample()) {
+        JT_CHECK_EQ(std::get<0>(*ints.Counterexample()), 1);
+    }
+}
+
+JT_TEST_ENTRY("jt-test", "Jt::formatValue escapes characters that would not print as themselves") {
+    JT_CHECK_EQ(Jt::formatValue(std::string("ab c")), "\"ab c\"");
+    JT_CHECK_EQ(Jt::formatValue(std::string("a\nb\tc\r\\\"")), R"("a\nb\tc\r\\\"")");
+    JT_CHECK_EQ(Jt::formatValue(std::string("\x01\x7f\xff")), R"("\x01\x7f\xff")");
+    JT_CHECK_EQ(Jt::formatValue('\n'), R"('\n')");
+    JT_CHECK_EQ(Jt::formatValue('\''), R"('\'')");
+    JT_CHECK_EQ(Jt::formatValue(std::vector<std::string>{ "x\ny" }), R"(["x\ny"])");
+
+    JT_GIVEN("a property failing on strings of arbitrary bytes");
+    JT_THEN("the reported counterexample stays on one line");
+    JtTestRunner tr;
+    std::string reported;
+    tr.AddListener([&](const JtScope::EventArgs& e) {
+        if (e.Name == "fail") {
+            reported = e.Scope->Text;
+        }
+    });
+    auto noNewline = Jt::forall(Jt::gen::strings(Jt::gen::chars(-128, 127), 0, 16));
+    noNewline.Check([](const std::string& s) { return s.find('\n') == std::string::npos; });
+    tr.Close();
+
+    JT_CHECK_EQ(std::get<0>(*noNewline.Counterexample()), "\n");
+    JT_CHECK(reported.find("\ncounterexample: (\"\\n\")\n") != std::string::npos);
+}
+
+JT_TEST_ENTRY("jt-test", "Jt::forall reproduces a failure from its seed") {
+    JT_GIVEN("a failing property run with an arbitrary seed");
+    JT_WHEN("it is run again with the reported seed");
+    JT_THEN("the same counterexample is found");
+
+    JtTestRunner tr;
+    auto property = [](int a, int b) { return a + b < 150; };
+    auto first = Jt::forall(Jt::gen::ints(0, 100), Jt::gen::ints(0, 100));
+    first.Check(property);
+    auto second = Jt::forall(Jt::gen::ints(0, 100), Jt::gen::ints(0, 100)).Seed(first.Seed());
+    second.Check(property);
+    tr.Close();
+
+    JT_CHECK_EQ(tr.FailCount(), 2);
+    JT_CHECK(first.Counterexample() == second.Counterexample());
+}
+
+JT_TEST_ENTRY("jt-test", "JT_FORALL reports JT_CHECK failures under the counterexample") {
+    JtTestRunner tr;
+    std::vector<std::string> traces;
+    tr.AddListener([&](const JtScope::EventArgs& e) {
+        if (e.Name == "fail") {
+            traces.push_back(Jt::getStackTrace(e.Scope));
+        }
+    });
+    JT_FORALL(Jt::forall(Jt::gen::ints(1, 1000)).Seed(42), [](int n) {
+        JT_CHECK(n < 100, "n = {}", n);
+    });
+    tr.Close();
+
+    JT_CHECK_EQ(tr.FailCount(), 1);
+    JT_CHECK_EQ(traces.size(), 1);
+    JT_CHECK(traces[0].find("counterexample: (100)") != std::string::npos);
+    JT_CHECK(traces[0].find("Seed(0x2a)") != std::string::npos);
+    JT_CHECK(traces[0].find("n = 100") != std::string::npos);
+}
+
 //------ enum tests ----------------------------------------
 namespace {
     namespace TestJt {